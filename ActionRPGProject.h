@@ -4,4 +4,6 @@
 
 #include "CoreMinimal.h"
 
-#define COLLISION_WEAPON ECC_GameTraceChannel1
\ No newline at end of file
+#define COLLISION_WEAPON ECC_GameTraceChannel1
+
+DECLARE_STATS_GROUP(TEXT("ActionRPG AI"), STATGROUP_ActionRPGAI, STATCAT_Advanced);
\ No newline at end of file
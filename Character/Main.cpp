@@ -16,6 +16,8 @@
 #include "../Weapons/MeleeWeapon.h"
 #include "../Weapons/Shield.h"
 #include "../Weapons/Weapon.h"
+#include "../World/EnemyNoiseSubsystem.h"
+#include "../World/EnemySpatialHashSubsystem.h"
 #include "../World/Pickup.h"
 #include "Animation/AnimInstance.h"
 #include "Camera/CameraComponent.h"
@@ -203,6 +205,7 @@ AMain::AMain()
 	DelayedHealthReportingValue = MaxHealth;
 	DelayedHealthBarValue = MaxHealth;
 	DelayedHealthBarDrainRate = 20.0f;
+	DelayedHealthBarChangeTime = 0.f;
 	TakeDamageDelay = 0.5f;
 
 	TotalHealthPotionCapacity = 0;
@@ -378,15 +381,6 @@ void AMain::Tick(float DeltaTime)
 	float DeltaStaminaDrain = StaminaDrainRate * DeltaTime;
 	float DeltaStaminaRegen = CurrentStaminaRegenRate * DeltaTime;
 
-	// determine how much red "delayed" health to drain after delay until meeting regular current health value (health bar effect)
-	float DeltaDelayedHealthBarDrain = DelayedHealthBarDrainRate * DeltaTime;
-
-	if (DelayedHealthBarValue > DelayedHealthReportingValue)
-	{ DelayedHealthBarValue -= DeltaDelayedHealthBarDrain; }
-
-	else if (DelayedHealthReportingValue > DelayedHealthBarValue)
-	{ DelayedHealthBarValue = DelayedHealthReportingValue; }
-
 	// manage StaminaStatus states
 	switch (StaminaStatus)
 	{
@@ -957,10 +951,23 @@ void AMain::ResetCanRegenStamina()
 }
 
 
+TArray<AEnemy*> AMain::GetPotentialSoftLockTargets(float Range, float HalfAngleDegrees)
+{
+	TArray<AEnemy*> PotentialTargets;
+
+	if (UEnemySpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UEnemySpatialHashSubsystem>())
+	{ SpatialHash->QueryCone(GetActorLocation(), GetActorForwardVector(), Range, HalfAngleDegrees, true, PotentialTargets); }
+
+	return PotentialTargets;
+}
+
 void AMain::PlayDodgeSound()
 {
 	if (DodgeSound)
 	{ UGameplayStatics::PlaySound2D(this, DodgeSound, 2.0f); }
+
+	if (UEnemyNoiseSubsystem* NoiseManager = GetWorld()->GetSubsystem<UEnemyNoiseSubsystem>())
+	{ NoiseManager->ReportNoise(EEnemyNoiseType::ENT_Dodge, GetActorLocation(), this); }
 }
 
 FVector AMain::GetMovementDirection()
@@ -1334,7 +1341,38 @@ void AMain::ProcessHealthPotionEffect()
 	else
 	{ Health = Health + HealthPotionRestoreAmount; }
 
-	DelayedHealthReportingValue = Health;
+	SetDelayedHealthReportingValue(Health);
+}
+
+
+float AMain::GetDelayedHealthBarValue() const
+{
+	const UWorld* World = GetWorld();
+	if (!World || DelayedHealthBarValue <= DelayedHealthReportingValue) { return DelayedHealthBarValue; }
+
+	return FMath::Max(DelayedHealthBarValue - DelayedHealthBarDrainRate * World->TimeSince(DelayedHealthBarChangeTime), DelayedHealthReportingValue);
+}
+
+
+void AMain::SetDelayedHealthReportingValue(float NewReportingValue)
+{
+	// restart the drain from wherever the bar is now; healing raises the bar straight to the new value
+	DelayedHealthBarValue = FMath::Max(GetDelayedHealthBarValue(), NewReportingValue);
+	DelayedHealthBarChangeTime = GetWorld()->GetTimeSeconds();
+	DelayedHealthReportingValue = NewReportingValue;
+
+	if (DelayedHealthBarValue > DelayedHealthReportingValue && DelayedHealthBarDrainRate > 0.f)
+	{ GetWorldTimerManager().SetTimer(DelayedHealthBarSettleTimer, this, &AMain::SettleDelayedHealthBar, (DelayedHealthBarValue - DelayedHealthReportingValue) / DelayedHealthBarDrainRate); }
+
+	else
+	{ GetWorldTimerManager().ClearTimer(DelayedHealthBarSettleTimer); }
+}
+
+
+void AMain::SettleDelayedHealthBar()
+{
+	DelayedHealthBarValue = FMath::Min(DelayedHealthBarValue, DelayedHealthReportingValue);
+	DelayedHealthBarChangeTime = GetWorld()->GetTimeSeconds();
 }
 
 
@@ -1602,6 +1640,9 @@ float AMain::TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEve
 			{ PushBackPlayerBP(Attacker); }
 		}
 
+		if (UEnemyNoiseSubsystem* NoiseManager = GetWorld()->GetSubsystem<UEnemyNoiseSubsystem>())
+		{ NoiseManager->ReportNoise(EEnemyNoiseType::ENT_Hit, GetActorLocation(), this); }
+
 		// play hit sound fx
 		if (HitSound1 && HitSound2 && HitSound3)
 		{
@@ -315,15 +315,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Stats")
 	float Health;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Stats")
+	// health the red "delayed" bar drains down to (or jumps up to, when healed); set through SetDelayedHealthReportingValue
+	UPROPERTY(EditAnywhere, BlueprintSetter = SetDelayedHealthReportingValue, Category = "Player Stats")
 	float DelayedHealthReportingValue;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Player Stats")
+	// value as of its last change; current value from GetDelayedHealthBarValue
+	UPROPERTY(VisibleAnywhere, BlueprintGetter = GetDelayedHealthBarValue, Category = "Player Stats")
 	float DelayedHealthBarValue;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Stats")
 	float DelayedHealthBarDrainRate;
 
+	// the bar drains linearly, so it's evaluated from the time of its last change rather than stepped every frame
+	UFUNCTION(BlueprintGetter)
+	float GetDelayedHealthBarValue() const;
+
+	UFUNCTION(BlueprintSetter)
+	void SetDelayedHealthReportingValue(float NewReportingValue);
+
+	float DelayedHealthBarChangeTime;
+
+	// fires once the drain reaches DelayedHealthReportingValue, to store the settled value
+	FTimerHandle DelayedHealthBarSettleTimer;
+
+	void SettleDelayedHealthBar();
+
 	FTimerHandle RespawnTimer;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
@@ -949,6 +965,10 @@ public:
 	UFUNCTION(BlueprintImplementableEvent)
 	void ComparePotentialSoftLockTargets();
 
+	// living enemies within Range, inside a cone of HalfAngleDegrees around the player's facing (for ComparePotentialSoftLockTargets)
+	UFUNCTION(BlueprintCallable)
+	TArray<AEnemy*> GetPotentialSoftLockTargets(float Range, float HalfAngleDegrees);
+
 	UFUNCTION(BlueprintImplementableEvent)
 	void DisableAttackRootMotionBP();
 